@@ -27,11 +27,14 @@ ii. conquistar certa quantidade territórios
 #include <string.h>
 #include <stdlib.h> // Necessário para calloc e free
 #include <time.h>   // Necessário para srand e time
+#include <float.h>  // Necessário para DBL_EPSILON
+#include <math.h>   // Necessário para log, exp e lgamma (compilar com -lm)
 
 // --- Constantes Globais ---
 // Definem valores fixos para o número de territórios, missões e tamanho máximo de strings, facilitando a manutenção.
 #define TAMANHO_NOME 30
 #define TAMANHO_COR 10
+#define TOP_K_RELATORIO 3 // Quantidade de territórios listados em cada ranking do relatório de ameaças
 
 // --- Estrutura de Dados ---
 // Define a estrutura para um território, contendo seu nome, a cor do exército que o domina e o número de tropas.
@@ -56,6 +59,27 @@ typedef struct {
     int progressoTotal;        // Alvo para a missão (N territórios ou N exércitos a destruir)
 } Missao;
 
+// --- Estruturas para o Relatório de Ameaças ---
+// Heap indexado de territórios, ordenado pela quantidade de tropas. O vetor de posições permite
+// reposicionar um território em O(log n) quando suas tropas mudam, sem reconstruir o heap.
+typedef struct {
+    int *indices;  // Índices dos territórios, na ordem do heap
+    int *posicao;  // posicao[i] = posição do território i no heap, ou -1 se ausente
+    int *tropas;   // tropas[i] = tropas do território i registradas na última atualização
+    int tamanho;
+    int ordem;     // 1 = heap de mínimo, -1 = heap de máximo
+} HeapTerritorios;
+
+// Mantém os territórios do jogador e dos inimigos separados em heaps de mínimo e de máximo,
+// para que os rankings possam ser exibidos a cada turno sem ordenar o mapa inteiro.
+typedef struct {
+    char corJogador[TAMANHO_COR];
+    HeapTerritorios aliadosMaisFracos;
+    HeapTerritorios aliadosMaisFortes;
+    HeapTerritorios inimigosMaisFracos;
+    HeapTerritorios inimigosMaisFortes;
+} RelatorioAmeacas;
+
 
 // --- Protótipos das Funções ---
 // Declarações antecipadas de todas as funções que serão usadas no programa, organizadas por categoria.
@@ -69,12 +93,30 @@ void liberarMemoria(Territorio *mapa);
 void atribuirMissao(Missao *missao, const Territorio *territorios, int totalTerritorios);
 int verificarMissaoCumprida(const Missao *missao, const Territorio *territorios, int totalTerritorios, int territoriosConquistados);
 int obterProgressoMissao(const Missao *missao, const Territorio *territorios, int totalTerritorios, int territoriosConquistados);
+double calcularChanceConquista(int tropasAtacante, int tropasDefensor);
+double somarBinomialNegativa(double chanceSucesso, int sucessos, int limiteFalhas);
+
+// Funções do relatório de ameaças (heaps indexados):
+int inicializarHeap(HeapTerritorios *heap, int capacidade, int ordem);
+void liberarHeap(HeapTerritorios *heap);
+int precedeNoHeap(const HeapTerritorios *heap, int indiceA, int indiceB);
+void trocarNoHeap(HeapTerritorios *heap, int posA, int posB);
+void subirNoHeap(HeapTerritorios *heap, int pos);
+void descerNoHeap(HeapTerritorios *heap, int pos);
+void inserirNoHeap(HeapTerritorios *heap, int indice, int tropas);
+void removerDoHeap(HeapTerritorios *heap, int indice);
+void atualizarNoHeap(HeapTerritorios *heap, int indice, int tropas);
+int obterTopK(const HeapTerritorios *heap, int *resultado);
+RelatorioAmeacas* criarRelatorioAmeacas(const Territorio *territorios, int totalTerritorios);
+void atualizarRelatorioAmeacas(RelatorioAmeacas *relatorio, const Territorio *territorios, int indice);
+void exibirRelatorioAmeacas(const RelatorioAmeacas *relatorio, const Territorio *territorios);
+void liberarRelatorioAmeacas(RelatorioAmeacas *relatorio);
 
 // Funções de setup e gerenciamento de memória:
 Territorio* inicializarJogo(int *totalTerritorios);
 int executarLoopPrincipal(Territorio *territorios, int totalTerritorios);
-void gerenciarFaseDeAtaque(Territorio *territorios, int totalTerritorios, int *territoriosConquistados);
-int executarFaseDeAtaque(Territorio *territorios, int totalTerritorios, Missao *missao, int *territoriosConquistados);
+void gerenciarFaseDeAtaque(Territorio *territorios, int totalTerritorios, int *territoriosConquistados, RelatorioAmeacas *relatorio);
+int executarFaseDeAtaque(Territorio *territorios, int totalTerritorios, Missao *missao, int *territoriosConquistados, RelatorioAmeacas *relatorio);
 
 // Remove caracteres residuais do buffer de entrada e evita problemas de leitura de strings
 void limparBuffer();
@@ -450,17 +492,460 @@ int obterProgressoMissao(const Missao *missao, const Territorio *territorios, in
     }
     return 0;
 }
+/**
+ * @brief Calcula a chance de obter um número de sucessos antes de um limite de falhas.
+ *
+ * Soma a série binomial negativa C(sucessos - 1 + j, j) * p^sucessos * (1 - p)^j para
+ * j = 0..limiteFalhas-1. A soma parte do maior termo, calculado em logaritmo com lgamma,
+ * e avança para os dois lados até os termos não alterarem mais o resultado. Assim exércitos
+ * grandes não zeram o termo inicial e o custo fica proporcional ao desvio, não às tropas.
+ *
+ * @param chanceSucesso Chance de sucesso em cada rodada.
+ * @param sucessos Sucessos necessários (>= 1).
+ * @param limiteFalhas Falhas que encerram a tentativa (>= 1).
+ * @return double Probabilidade, entre 0 e 1.
+ */
+double somarBinomialNegativa(double chanceSucesso, int sucessos, int limiteFalhas) {
+    const double chanceFalha = 1.0 - chanceSucesso;
+
+    // Termo mais provável da série, limitado ao intervalo somado
+    double modaReal = (sucessos - 1.0) * chanceFalha / chanceSucesso;
+    int moda = modaReal < limiteFalhas - 1 ? (int)modaReal : limiteFalhas - 1;
+    double logMaiorTermo = lgamma((double)sucessos + moda) - lgamma(sucessos) - lgamma(moda + 1.0)
+                         + sucessos * log(chanceSucesso) + moda * log(chanceFalha);
+
+    // Termos relativos ao maior; decrescem monotonicamente a partir da moda
+    double soma = 1.0;
+    double termo = 1.0;
+    for (int j = moda + 1; j < limiteFalhas; j++) {
+        termo *= chanceFalha * ((double)sucessos + j - 1) / j;
+        soma += termo;
+        if (termo < soma * DBL_EPSILON) break;
+    }
+    termo = 1.0;
+    for (int j = moda; j > 0; j--) {
+        termo /= chanceFalha * ((double)sucessos + j - 1) / j;
+        soma += termo;
+        if (termo < soma * DBL_EPSILON) break;
+    }
+
+    double resultado = exp(log(soma) + logMaiorTermo);
+    return resultado > 1.0 ? 1.0 : resultado;
+}
+
+/**
+ * @brief Calcula a chance de o atacante conquistar o defensor atacando até não poder mais.
+ *
+ * Cada rodada de atacar() rola um dado para cada lado e o atacante vence com chance 15/36.
+ * O atacante conquista se obtiver tantas vitórias quanto as tropas do defensor antes de
+ * sofrer (tropasAtacante - 1) derrotas, o que é uma soma da distribuição binomial negativa.
+ * Um defensor sem tropas ainda exige uma rodada vencida, pois atacar() só conquista após
+ * uma vitória do atacante.
+ * Soma a série direta ou a complementar (chance de o defensor vencer primeiro), a que tiver
+ * menos termos.
+ *
+ * @param tropasAtacante Tropas no território atacante.
+ * @param tropasDefensor Tropas no território defensor.
+ * @return double Probabilidade de conquista, entre 0 e 1.
+ */
+double calcularChanceConquista(int tropasAtacante, int tropasDefensor) {
+    const double chanceRodada = 15.0 / 36.0; // Dado de ataque estritamente maior que o de defesa
+    int vitoriasNecessarias = tropasDefensor > 0 ? tropasDefensor : 1;
+    int derrotasToleradas = tropasAtacante - 1;
+
+    if (derrotasToleradas <= 0) return 0.0; // atacar() recusa atacantes com 1 tropa ou menos
+
+    if (derrotasToleradas <= vitoriasNecessarias) {
+        return somarBinomialNegativa(chanceRodada, vitoriasNecessarias, derrotasToleradas);
+    }
+    return 1.0 - somarBinomialNegativa(1.0 - chanceRodada, derrotasToleradas, vitoriasNecessarias);
+}
+
+// --- Funções do Relatório de Ameaças ---
+
+/**
+ * @brief Aloca os vetores de um heap indexado vazio.
+ * @param heap Ponteiro para o heap a ser inicializado.
+ * @param capacidade Número total de territórios do mapa.
+ * @param ordem 1 para heap de mínimo, -1 para heap de máximo.
+ * @return int Retorna 1 em caso de sucesso, 0 se a alocação falhar.
+ */
+int inicializarHeap(HeapTerritorios *heap, int capacidade, int ordem) {
+    heap->indices = (int *) calloc(capacidade, sizeof(int));
+    heap->posicao = (int *) calloc(capacidade, sizeof(int));
+    heap->tropas = (int *) calloc(capacidade, sizeof(int));
+    heap->tamanho = 0;
+    heap->ordem = ordem;
+    if (heap->indices == NULL || heap->posicao == NULL || heap->tropas == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < capacidade; i++) {
+        heap->posicao[i] = -1;
+    }
+    return 1;
+}
+
+/**
+ * @brief Libera os vetores alocados para um heap indexado.
+ * @param heap Ponteiro para o heap.
+ */
+void liberarHeap(HeapTerritorios *heap) {
+    free(heap->indices);
+    free(heap->posicao);
+    free(heap->tropas);
+    heap->indices = NULL;
+    heap->posicao = NULL;
+    heap->tropas = NULL;
+    heap->tamanho = 0;
+}
+
+/**
+ * @brief Indica se o território A deve ficar acima do território B no heap.
+ * Empates de tropas são desfeitos pelo índice, para que os rankings sejam estáveis.
+ */
+int precedeNoHeap(const HeapTerritorios *heap, int indiceA, int indiceB) {
+    int tropasA = heap->tropas[indiceA];
+    int tropasB = heap->tropas[indiceB];
+    if (tropasA != tropasB) {
+        return heap->ordem > 0 ? tropasA < tropasB : tropasA > tropasB;
+    }
+    return indiceA < indiceB;
+}
+
+/**
+ * @brief Troca dois elementos do heap, mantendo o vetor de posições consistente.
+ */
+void trocarNoHeap(HeapTerritorios *heap, int posA, int posB) {
+    int temp = heap->indices[posA];
+    heap->indices[posA] = heap->indices[posB];
+    heap->indices[posB] = temp;
+    heap->posicao[heap->indices[posA]] = posA;
+    heap->posicao[heap->indices[posB]] = posB;
+}
+
+/**
+ * @brief Sobe o elemento na posição informada até restaurar a propriedade do heap.
+ */
+void subirNoHeap(HeapTerritorios *heap, int pos) {
+    while (pos > 0) {
+        int pai = (pos - 1) / 2;
+        if (!precedeNoHeap(heap, heap->indices[pos], heap->indices[pai])) {
+            break;
+        }
+        trocarNoHeap(heap, pos, pai);
+        pos = pai;
+    }
+}
+
+/**
+ * @brief Desce o elemento na posição informada até restaurar a propriedade do heap.
+ */
+void descerNoHeap(HeapTerritorios *heap, int pos) {
+    while (1) {
+        int melhor = pos;
+        int esquerda = 2 * pos + 1;
+        int direita = 2 * pos + 2;
+        if (esquerda < heap->tamanho && precedeNoHeap(heap, heap->indices[esquerda], heap->indices[melhor])) {
+            melhor = esquerda;
+        }
+        if (direita < heap->tamanho && precedeNoHeap(heap, heap->indices[direita], heap->indices[melhor])) {
+            melhor = direita;
+        }
+        if (melhor == pos) {
+            break;
+        }
+        trocarNoHeap(heap, pos, melhor);
+        pos = melhor;
+    }
+}
+
+/**
+ * @brief Insere um território no heap em O(log n).
+ * @param heap Ponteiro para o heap.
+ * @param indice Índice do território no mapa.
+ * @param tropas Quantidade atual de tropas do território.
+ */
+void inserirNoHeap(HeapTerritorios *heap, int indice, int tropas) {
+    heap->tropas[indice] = tropas;
+    heap->indices[heap->tamanho] = indice;
+    heap->posicao[indice] = heap->tamanho;
+    heap->tamanho++;
+    subirNoHeap(heap, heap->tamanho - 1);
+}
+
+/**
+ * @brief Remove um território do heap em O(log n). Não faz nada se ele não estiver presente.
+ * @param heap Ponteiro para o heap.
+ * @param indice Índice do território no mapa.
+ */
+void removerDoHeap(HeapTerritorios *heap, int indice) {
+    int pos = heap->posicao[indice];
+    if (pos == -1) {
+        return;
+    }
+    heap->tamanho--;
+    heap->posicao[indice] = -1;
+    if (pos < heap->tamanho) {
+        // Move o último elemento para a vaga e o reposiciona
+        int movido = heap->indices[heap->tamanho];
+        heap->indices[pos] = movido;
+        heap->posicao[movido] = pos;
+        subirNoHeap(heap, pos);
+        descerNoHeap(heap, heap->posicao[movido]);
+    }
+}
+
+/**
+ * @brief Atualiza as tropas registradas de um território já presente no heap em O(log n).
+ * @param heap Ponteiro para o heap.
+ * @param indice Índice do território no mapa.
+ * @param tropas Nova quantidade de tropas do território.
+ */
+void atualizarNoHeap(HeapTerritorios *heap, int indice, int tropas) {
+    int pos = heap->posicao[indice];
+    if (pos == -1) {
+        return;
+    }
+    heap->tropas[indice] = tropas;
+    subirNoHeap(heap, pos);
+    descerNoHeap(heap, heap->posicao[indice]);
+}
+
+/**
+ * @brief Obtém os TOP_K_RELATORIO primeiros territórios do heap, em ordem, sem modificá-lo.
+ *
+ * Percorre o heap com uma fila de prioridade auxiliar de candidatos (posições cujo pai já
+ * foi escolhido), o que custa O(k log k) em vez de ordenar todos os territórios.
+ * O vetor de candidatos tem tamanho fixo, sem alocação a cada exibição.
+ *
+ * @param heap Ponteiro para o heap consultado.
+ * @param resultado Vetor com espaço para TOP_K_RELATORIO índices, preenchido em ordem de prioridade.
+ * @return int Quantidade de índices escritos em resultado.
+ */
+int obterTopK(const HeapTerritorios *heap, int *resultado) {
+    int k = TOP_K_RELATORIO;
+    if (k > heap->tamanho) k = heap->tamanho;
+    if (k <= 0) return 0;
+
+    int candidatos[TOP_K_RELATORIO + 1]; // Posições no heap principal
+    int numCandidatos = 1;
+    int encontrados = 0;
+    candidatos[0] = 0; // A raiz é sempre o primeiro
+
+    while (encontrados < k) {
+        int pos = candidatos[0];
+        resultado[encontrados++] = heap->indices[pos];
+
+        // Remove o topo dos candidatos e desce o último elemento
+        candidatos[0] = candidatos[--numCandidatos];
+        int atual = 0;
+        while (1) {
+            int melhor = atual;
+            int esquerda = 2 * atual + 1;
+            int direita = 2 * atual + 2;
+            if (esquerda < numCandidatos && precedeNoHeap(heap, heap->indices[candidatos[esquerda]], heap->indices[candidatos[melhor]])) {
+                melhor = esquerda;
+            }
+            if (direita < numCandidatos && precedeNoHeap(heap, heap->indices[candidatos[direita]], heap->indices[candidatos[melhor]])) {
+                melhor = direita;
+            }
+            if (melhor == atual) break;
+            int temp = candidatos[atual];
+            candidatos[atual] = candidatos[melhor];
+            candidatos[melhor] = temp;
+            atual = melhor;
+        }
+
+        // Os filhos do escolhido passam a ser candidatos
+        for (int filho = 2 * pos + 1; filho <= 2 * pos + 2 && encontrados < k; filho++) {
+            if (filho >= heap->tamanho) break;
+            atual = numCandidatos;
+            candidatos[numCandidatos++] = filho;
+            while (atual > 0) {
+                int pai = (atual - 1) / 2;
+                if (!precedeNoHeap(heap, heap->indices[candidatos[atual]], heap->indices[candidatos[pai]])) break;
+                int temp = candidatos[atual];
+                candidatos[atual] = candidatos[pai];
+                candidatos[pai] = temp;
+                atual = pai;
+            }
+        }
+    }
+
+    return encontrados;
+}
+
+/**
+ * @brief Cria o relatório de ameaças, separando os territórios do jogador e dos inimigos.
+ *
+ * Os heaps são montados de baixo para cima em O(n); depois disso, cada mudança de tropas
+ * ou de dono é aplicada com atualizarRelatorioAmeacas() em O(log n).
+ *
+ * @param territorios Ponteiro para o vetor de territórios.
+ * @param totalTerritorios Número total de territórios.
+ * @return RelatorioAmeacas* Relatório alocado dinamicamente, ou NULL em caso de falha.
+ */
+RelatorioAmeacas* criarRelatorioAmeacas(const Territorio *territorios, int totalTerritorios) {
+    RelatorioAmeacas *relatorio = (RelatorioAmeacas *) calloc(1, sizeof(RelatorioAmeacas));
+    if (relatorio == NULL) {
+        return NULL;
+    }
+    // Assume que o jogador é o primeiro, como em atribuirMissao
+    strcpy(relatorio->corJogador, territorios[0].corExercito);
+
+    HeapTerritorios *heaps[] = {
+        &relatorio->aliadosMaisFracos, &relatorio->aliadosMaisFortes,
+        &relatorio->inimigosMaisFracos, &relatorio->inimigosMaisFortes
+    };
+    const int ordens[] = {1, -1, 1, -1};
+    for (int h = 0; h < 4; h++) {
+        if (!inicializarHeap(heaps[h], totalTerritorios, ordens[h])) {
+            liberarRelatorioAmeacas(relatorio);
+            return NULL;
+        }
+    }
+
+    // Distribui os territórios sem ordenar e depois constrói cada heap de baixo para cima
+    for (int i = 0; i < totalTerritorios; i++) {
+        int primeiro = strcmp(territorios[i].corExercito, relatorio->corJogador) == 0 ? 0 : 2;
+        for (int h = primeiro; h < primeiro + 2; h++) {
+            heaps[h]->tropas[i] = territorios[i].quantidadeTropas;
+            heaps[h]->indices[heaps[h]->tamanho] = i;
+            heaps[h]->posicao[i] = heaps[h]->tamanho;
+            heaps[h]->tamanho++;
+        }
+    }
+    for (int h = 0; h < 4; h++) {
+        for (int pos = heaps[h]->tamanho / 2 - 1; pos >= 0; pos--) {
+            descerNoHeap(heaps[h], pos);
+        }
+    }
+    return relatorio;
+}
+
+/**
+ * @brief Aplica ao relatório a situação atual de um território (tropas e dono).
+ * Deve ser chamada para cada território alterado, por exemplo após atacar().
+ * @param relatorio Ponteiro para o relatório (ignorado se NULL).
+ * @param territorios Ponteiro para o vetor de territórios.
+ * @param indice Índice do território que mudou.
+ */
+void atualizarRelatorioAmeacas(RelatorioAmeacas *relatorio, const Territorio *territorios, int indice) {
+    if (relatorio == NULL) {
+        return;
+    }
+    const Territorio *territorio = &territorios[indice];
+    int ehAliado = strcmp(territorio->corExercito, relatorio->corJogador) == 0;
+    int eraAliado = relatorio->aliadosMaisFracos.posicao[indice] != -1;
+
+    if (ehAliado == eraAliado) {
+        HeapTerritorios *maisFracos = ehAliado ? &relatorio->aliadosMaisFracos : &relatorio->inimigosMaisFracos;
+        HeapTerritorios *maisFortes = ehAliado ? &relatorio->aliadosMaisFortes : &relatorio->inimigosMaisFortes;
+        atualizarNoHeap(maisFracos, indice, territorio->quantidadeTropas);
+        atualizarNoHeap(maisFortes, indice, territorio->quantidadeTropas);
+    } else if (ehAliado) { // Conquistado pelo jogador
+        removerDoHeap(&relatorio->inimigosMaisFracos, indice);
+        removerDoHeap(&relatorio->inimigosMaisFortes, indice);
+        inserirNoHeap(&relatorio->aliadosMaisFracos, indice, territorio->quantidadeTropas);
+        inserirNoHeap(&relatorio->aliadosMaisFortes, indice, territorio->quantidadeTropas);
+    } else { // Perdido para um inimigo
+        removerDoHeap(&relatorio->aliadosMaisFracos, indice);
+        removerDoHeap(&relatorio->aliadosMaisFortes, indice);
+        inserirNoHeap(&relatorio->inimigosMaisFracos, indice, territorio->quantidadeTropas);
+        inserirNoHeap(&relatorio->inimigosMaisFortes, indice, territorio->quantidadeTropas);
+    }
+}
+
+/**
+ * @brief Exibe os territórios aliados mais vulneráveis e as melhores oportunidades de ataque.
+ *
+ * Como qualquer território inimigo pode ser atacado, a maior ameaça a um aliado é o inimigo
+ * mais forte, e o melhor atacante contra um alvo é o aliado mais forte. Assim, os rankings
+ * saem dos k menores de cada lado combinados com o topo do heap de máximo do lado oposto.
+ *
+ * @param relatorio Ponteiro para o relatório (ignorado se NULL).
+ * @param territorios Ponteiro para o vetor de territórios.
+ */
+void exibirRelatorioAmeacas(const RelatorioAmeacas *relatorio, const Territorio *territorios) {
+    if (relatorio == NULL) {
+        return;
+    }
+    int ranking[TOP_K_RELATORIO];
+    int quantidade;
+
+    printf("\n RELATÓRIO DE AMEAÇAS (exército %s)\n", relatorio->corJogador);
+    printf("-------------------------------------------------------------\n");
+
+    printf(" Territórios aliados mais vulneráveis:\n");
+    quantidade = obterTopK(&relatorio->aliadosMaisFracos, ranking);
+    if (quantidade == 0) {
+        printf("   Nenhum território aliado.\n");
+    }
+    for (int i = 0; i < quantidade; i++) {
+        const Territorio *aliado = &territorios[ranking[i]];
+        printf("   %d. %s (%d tropas)", i + 1, aliado->nome, aliado->quantidadeTropas);
+        if (relatorio->inimigosMaisFortes.tamanho > 0) {
+            const Territorio *ameaca = &territorios[relatorio->inimigosMaisFortes.indices[0]];
+            int defesa = aliado->quantidadeTropas > 0 ? aliado->quantidadeTropas : 1;
+            printf(" - ameaça: %s (%d tropas, razão %.2f, chance de perda %.1f%%)",
+                   ameaca->nome, ameaca->quantidadeTropas, (float)ameaca->quantidadeTropas / defesa,
+                   calcularChanceConquista(ameaca->quantidadeTropas, aliado->quantidadeTropas) * 100.0);
+        }
+        printf("\n");
+    }
+
+    printf(" Melhores oportunidades de ataque:\n");
+    const Territorio *atacante = NULL;
+    if (relatorio->aliadosMaisFortes.tamanho > 0) {
+        atacante = &territorios[relatorio->aliadosMaisFortes.indices[0]];
+    }
+    if (atacante == NULL || atacante->quantidadeTropas <= 1) {
+        printf("   Nenhum território aliado tem tropas suficientes para atacar.\n");
+    } else {
+        quantidade = obterTopK(&relatorio->inimigosMaisFracos, ranking);
+        if (quantidade == 0) {
+            printf("   Nenhum território inimigo.\n");
+        }
+        for (int i = 0; i < quantidade; i++) {
+            const Territorio *alvo = &territorios[ranking[i]];
+            int defesa = alvo->quantidadeTropas > 0 ? alvo->quantidadeTropas : 1;
+            printf("   %d. %s (%d) -> %s (%s, %d tropas) - razão %.2f, chance de vitória %.1f%%\n",
+                   i + 1, atacante->nome, atacante->quantidadeTropas, alvo->nome, alvo->corExercito,
+                   alvo->quantidadeTropas, (float)atacante->quantidadeTropas / defesa,
+                   calcularChanceConquista(atacante->quantidadeTropas, alvo->quantidadeTropas) * 100.0);
+        }
+    }
+    printf("-------------------------------------------------------------\n");
+}
+
+/**
+ * @brief Libera a memória alocada para o relatório de ameaças.
+ * @param relatorio Ponteiro para o relatório (pode ser NULL).
+ */
+void liberarRelatorioAmeacas(RelatorioAmeacas *relatorio) {
+    if (relatorio == NULL) {
+        return;
+    }
+    liberarHeap(&relatorio->aliadosMaisFracos);
+    liberarHeap(&relatorio->aliadosMaisFortes);
+    liberarHeap(&relatorio->inimigosMaisFracos);
+    liberarHeap(&relatorio->inimigosMaisFortes);
+    free(relatorio);
+}
+
 /**
  * @brief Gerencia a fase de ataque, solicitando ao jogador os territórios e validando a ação.
  * @param territorios Ponteiro para o vetor de territórios.
  * @param totalTerritorios Número total de territórios.
  * @param territoriosConquistados Ponteiro para a contagem de territórios conquistados.
+ * @param relatorio Ponteiro para o relatório de ameaças, atualizado após a batalha.
  */
-void gerenciarFaseDeAtaque(Territorio *territorios, int totalTerritorios, int *territoriosConquistados) {
+void gerenciarFaseDeAtaque(Territorio *territorios, int totalTerritorios, int *territoriosConquistados, RelatorioAmeacas *relatorio) {
     int idxAtacante, idxDefensor;
 
     printf("\n--- FASE DE ATAQUE ---\n");
     exibirMapaCompleto(territorios, totalTerritorios);
+    exibirRelatorioAmeacas(relatorio, territorios);
     printf("Escolha o número do território ATACANTE (ou 0 para voltar): ");
     scanf("%d", &idxAtacante);
     if (idxAtacante == 0) return;
@@ -487,6 +972,9 @@ void gerenciarFaseDeAtaque(Territorio *territorios, int totalTerritorios, int *t
         if (atacar(atacante, defensor)) {
             (*territoriosConquistados)++;
         }
+        // Apenas os dois territórios envolvidos mudaram
+        atualizarRelatorioAmeacas(relatorio, territorios, idxAtacante - 1);
+        atualizarRelatorioAmeacas(relatorio, territorios, idxDefensor - 1);
 
         // Exibe o status atualizado dos territórios envolvidos
         printf("\n--- SITUAÇÃO PÓS-BATALHA ---\n");
@@ -503,9 +991,10 @@ void gerenciarFaseDeAtaque(Territorio *territorios, int totalTerritorios, int *t
  * @param totalTerritorios Número total de territórios.
  * @param missao Ponteiro para a missão atual.
  * @param territoriosConquistados Ponteiro para a contagem de territórios conquistados.
+ * @param relatorio Ponteiro para o relatório de ameaças.
  * @return int Retorna 1 se a missão foi cumprida, 0 caso contrário.
  */
-int executarFaseDeAtaque(Territorio *territorios, int totalTerritorios, Missao *missao, int *territoriosConquistados) {
+int executarFaseDeAtaque(Territorio *territorios, int totalTerritorios, Missao *missao, int *territoriosConquistados, RelatorioAmeacas *relatorio) {
     int opcao;
     do {
         int progressoAtual = obterProgressoMissao(missao, territorios, totalTerritorios, *territoriosConquistados);
@@ -524,7 +1013,7 @@ int executarFaseDeAtaque(Territorio *territorios, int totalTerritorios, Missao *
 
         switch (opcao) {
             case 1:
-                gerenciarFaseDeAtaque(territorios, totalTerritorios, territoriosConquistados);
+                gerenciarFaseDeAtaque(territorios, totalTerritorios, territoriosConquistados, relatorio);
                 // Verifica se a missão foi cumprida após o ataque
                 if (verificarMissaoCumprida(missao, territorios, totalTerritorios, *territoriosConquistados)) {
                     return 1; // Sinaliza que a missão foi cumprida
@@ -555,6 +1044,11 @@ int executarLoopPrincipal(Territorio *territorios, int totalTerritorios) {
 
     atribuirMissao(&missaoAtual, territorios, totalTerritorios);
 
+    RelatorioAmeacas *relatorio = criarRelatorioAmeacas(territorios, totalTerritorios);
+    if (relatorio == NULL) {
+        printf("Erro de alocação de memória. O relatório de ameaças não será exibido.\n");
+    }
+
     do {
         int progressoAtual = obterProgressoMissao(&missaoAtual, territorios, totalTerritorios, territoriosConquistados);
 
@@ -577,15 +1071,17 @@ int executarLoopPrincipal(Territorio *territorios, int totalTerritorios) {
                 break;
             case 2:
                 // Entra no loop da fase de ataque e verifica se a missão foi cumprida lá
-                if (executarFaseDeAtaque(territorios, totalTerritorios, &missaoAtual, &territoriosConquistados)) {
+                if (executarFaseDeAtaque(territorios, totalTerritorios, &missaoAtual, &territoriosConquistados, relatorio)) {
                     printf("\n\n====================================================\n");
                     printf("!!! PARABÉNS, VOCÊ CUMPRIU SUA MISSÃO: %s !!!\n", missaoAtual.descricao);
                     printf("====================================================\n\n");
+                    liberarRelatorioAmeacas(relatorio);
                     return 1; // Retorna 1 para indicar que a missão foi cumprida
                 }
                 break;
             case 3:
                 calcularEstatisticas(territorios, totalTerritorios);
+                exibirRelatorioAmeacas(relatorio, territorios);
                 break;
             case 0:
                 break;
@@ -593,6 +1089,7 @@ int executarLoopPrincipal(Territorio *territorios, int totalTerritorios) {
                 printf("\nOpção inválida! Tente novamente.\n");
         }
     } while (opcao != 0);
+    liberarRelatorioAmeacas(relatorio);
     return 0; // Retorna 0 para indicar saída normal pelo menu
 }
 